@@ -0,0 +1,6 @@
+#include <rkc_sprad_cache.H>
+
+namespace rkc_sprad_cache
+{
+    AMREX_GPU_MANAGED amrex::Array1D<entry_t, 0, ncache-1> entries;
+}
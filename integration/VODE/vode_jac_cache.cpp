@@ -0,0 +1,9 @@
+#include <vode_jac_cache.H>
+
+#ifdef VODE_JAC_CACHE
+namespace vode_jac_cache
+{
+    AMREX_GPU_MANAGED entry_t* entries{nullptr};
+    AMREX_GPU_MANAGED int nentries{0};
+}
+#endif
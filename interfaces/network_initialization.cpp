@@ -10,6 +10,10 @@
 #endif
 #ifdef NSE_NET
 #include <nse_solver.H>
+#include <nse_check.H>
+#endif
+#ifdef VODE_JAC_CACHE
+#include <vode_jac_cache.H>
 #endif
 #endif
 
@@ -26,6 +30,15 @@ nonaka_init();
 #else
     actual_network_init();
     actual_rhs_init();
+#ifdef NSE_NET
+    init_nse_check();
+#endif
+#endif
+#ifdef NSE_NET
+    init_nse_guess_table();
+#endif
+#ifdef VODE_JAC_CACHE
+    init_vode_jac_cache();
 #endif
 
 #endif
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Add the automatic differentiation Jacobian option (USE_AD_JACOBIAN)
+to the actual_rhs.H of a pynucastro network.
+
+pynucastro writes rhs_nuc() for amrex::Real only.  This templates it
+on the number types of ydot_nuc and Y, and has actual_jac() call
+ad_jac_nuc() (networks/ad_jacobian.H) instead of jac_nuc() when the
+option is on.  update_pynucastro_nets.py runs this on each network it
+regenerates; it does nothing to a file that already has the edit.
+
+usage: add_ad_jacobian.py actual_rhs.H [actual_rhs.H ...]
+"""
+
+import sys
+from pathlib import Path
+
+RHS_NUC = """AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void rhs_nuc(const burn_t& state,
+             amrex::Array1D<amrex::Real, 1, neqs>& ydot_nuc,
+             const amrex::Array1D<amrex::Real, 1, NumSpec>& Y,
+             const amrex::Array1D<amrex::Real, 1, NumRates>& screened_rates) {"""
+
+RHS_NUC_AD = """template <typename ydot_t, typename number_t>
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void rhs_nuc(const burn_t& state,
+             amrex::Array1D<ydot_t, 1, neqs>& ydot_nuc,
+             const amrex::Array1D<number_t, 1, NumSpec>& Y,
+             const amrex::Array1D<amrex::Real, 1, NumRates>& screened_rates) {"""
+
+JAC_NUC_CALL = "    jac_nuc(state, jac, Y, rate_eval.screened_rates);\n"
+
+JAC_NUC_CALL_AD = """#ifdef AD_JACOBIAN
+    ad_jac_nuc(jac, Y,
+               [&] (auto& ydot_ad, const auto& Y_ad) {
+                   rhs_nuc(state, ydot_ad, Y_ad, rate_eval.screened_rates);
+               });
+#else
+""" + JAC_NUC_CALL + "#endif\n"
+
+INCLUDE = "#include <table_rates.H>\n"
+
+INCLUDE_AD = INCLUDE + "#ifdef AD_JACOBIAN\n#include <ad_jacobian.H>\n#endif\n"
+
+
+def replace_once(s, old, new, path):
+    """replace the one occurrence of old in s with new"""
+    if s.count(old) != 1:
+        raise ValueError(f"{path}: expected one occurrence of:\n{old}")
+    return s.replace(old, new)
+
+
+def add_ad_jacobian(path):
+    """edit the actual_rhs.H at path, and return whether it changed"""
+
+    path = Path(path)
+    s = path.read_text()
+
+    if "AD_JACOBIAN" in s:
+        return False
+
+    s = replace_once(s, INCLUDE, INCLUDE_AD, path)
+    s = replace_once(s, RHS_NUC, RHS_NUC_AD, path)
+
+    # jac_nuc() is kept with the option on: it is a template, so it
+    # is not instantiated unless something (like test_jac) calls it
+
+    s = replace_once(s, JAC_NUC_CALL, JAC_NUC_CALL_AD, path)
+
+    path.write_text(s)
+    return True
+
+
+if __name__ == "__main__":
+    for f in sys.argv[1:]:
+        if add_ad_jacobian(f):
+            print(f"added the AD Jacobian to {f}")
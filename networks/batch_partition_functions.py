@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""Store the partition function tables of a pynucastro network by
+temperature grid, and evaluate all of the nuclei at once.
+
+pynucastro writes one log10(partition function) table per nucleus, and
+get_partition_function_cached() fills the cache one nucleus at a time,
+each with its own binary search of the temperature grid.  This
+rewrites a generated partition_functions.H so the tables that share a
+grid form one 2-D array, pf_array_N[nnuc_N][npts_N] (with the nuclei
+of the rows in nuc_N), and the first cached lookup of a rate
+evaluation fills the cache for every nucleus, with one search per
+grid.  get_partition_function() keeps its interface and reads a row
+of the new tables.
+
+update_pynucastro_nets.py runs this on each network it regenerates; it
+does nothing to a file that already has the change.
+
+usage: batch_partition_functions.py partition_functions.H [...]
+"""
+
+import re
+import sys
+from pathlib import Path
+
+COMMON_OLD_START = '    // interpolation routine'
+
+COMMON_NEW = '''    // find the interval of the temperature grid that contains t9, so
+    // temp_array[idx] <= t9 < temp_array[idx+1].  Returns -1 if t9 is
+    // outside of the grid.
+
+    template <int npts>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    int find_pf_interval(const amrex::Real t9, const amrex::Real (&temp_array)[npts]) {
+
+        if (t9 < temp_array[0] || t9 >= temp_array[npts-1]) {
+            return -1;
+        }
+
+        // find the largest temperature element <= t9 using a binary search
+
+        int left = 0;
+        int right = npts;
+
+        while (left < right) {
+            int mid = (left + right) / 2;
+            if (temp_array[mid] > t9) {
+                right = mid;
+            } else {
+                left = mid + 1;
+            }
+        }
+
+        return right - 1;
+    }
+
+    // interpolation routine
+
+    template <int npts>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_pf(const amrex::Real t9, const amrex::Real (&temp_array)[npts], const amrex::Real (&pf_array)[npts],
+                        amrex::Real& pf, amrex::Real& dpf_dT) {
+
+        const int idx = find_pf_interval(t9, temp_array);
+
+        if (idx >= 0) {
+
+            // construct the slope -- this is (log10(pf_{i+1}) - log10(pf_i)) / (T_{i+1} - T_i)
+
+            amrex::Real slope = (pf_array[idx+1] - pf_array[idx]) / (temp_array[idx+1] - temp_array[idx]);
+
+            // find the PF
+
+            amrex::Real log10_pf = pf_array[idx] + slope * (t9 - temp_array[idx]);
+            pf = std::pow(10.0_rt, log10_pf);
+
+            // find the derivative (with respect to T, not T9)
+
+            amrex::Real dpf_dT9 = pf * M_LN10 * slope;
+            dpf_dT = dpf_dT9 / 1.e9_rt;
+
+        } else {
+
+            // T < the smallest T or >= the largest T in the partition function table
+            pf = 1.0;
+            dpf_dT = 0.0;
+
+        }
+
+    }
+
+    struct pf_cache_t {
+        // The partition function and its derivative for every nucleus,
+        // stored adjacent in memory, as they're always accessed at the
+        // same time.  These are all evaluated together the first time
+        // any of them is needed (see fill_partition_functions()).
+        amrex::Array2D<amrex::Real, 1, NumSpecTotal, 1, 2, Order::C> data{};
+        bool filled{false};
+    };
+
+    // evaluate the partition functions of all of the nuclei that share
+    // a temperature grid, storing them in the cache.  The interval is
+    // found once for the grid, and the interpolation for each nucleus
+    // is then independent of the others.
+
+    template <int npts, int nnuc>
+    AMREX_GPU_HOST_DEVICE AMREX_INLINE
+    void interpolate_pf_batch(const amrex::Real t9, const amrex::Real (&temp_array)[npts],
+                              const int (&nuc)[nnuc], const amrex::Real (&pf_array)[nnuc][npts],
+                              pf_cache_t& pf_cache) {
+
+        const int idx = find_pf_interval(t9, temp_array);
+
+        if (idx < 0) {
+            // outside of the table, the partition functions are 1
+            return;
+        }
+
+        const amrex::Real dT9_inv = 1.0_rt / (temp_array[idx+1] - temp_array[idx]);
+        const amrex::Real dt9 = t9 - temp_array[idx];
+
+        amrex::Real log10_pf[nnuc];
+        amrex::Real slope[nnuc];
+
+        for (int n = 0; n < nnuc; ++n) {
+            slope[n] = (pf_array[n][idx+1] - pf_array[n][idx]) * dT9_inv;
+            log10_pf[n] = pf_array[n][idx] + slope[n] * dt9;
+        }
+
+        for (int n = 0; n < nnuc; ++n) {
+            const amrex::Real pf = std::pow(10.0_rt, log10_pf[n]);
+            pf_cache.data(nuc[n], 1) = pf;
+            pf_cache.data(nuc[n], 2) = pf * M_LN10 * slope[n] / 1.e9_rt;
+        }
+
+    }
+
+}
+'''
+
+CACHED_NEW_TMPL = '''// evaluate the partition functions of all of the nuclei at once
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void fill_partition_functions([[maybe_unused]] const tf_t& tfactors, part_fun::pf_cache_t& pf_cache) {
+
+    // nuclei without a partition function table have pf = 1
+
+    for (int n = 1; n <= NumSpecTotal; ++n) {
+        pf_cache.data(n, 1) = 1.0_rt;
+        pf_cache.data(n, 2) = 0.0_rt;
+    }
+%s
+    pf_cache.filled = true;
+
+}
+
+AMREX_GPU_HOST_DEVICE AMREX_INLINE
+void get_partition_function_cached(const int inuc, const tf_t& tfactors,
+                                   part_fun::pf_cache_t& pf_cache,
+                                   amrex::Real& pf, amrex::Real& dpf_dT) {
+    if (! pf_cache.filled) {
+        fill_partition_functions(tfactors, pf_cache);
+    }
+    pf = pf_cache.data(inuc, 1);
+    dpf_dT = pf_cache.data(inuc, 2);
+}
+
+'''
+
+
+TABLE_RE = re.compile(r'    // this is log10\(partition function\)\n\n'
+                      r'    MICROPHYSICS_UNUSED HIP_CONSTEXPR static AMREX_GPU_MANAGED amrex::Real '
+                      r'(\w+)_pf_array\[npts_(\d+)\] = \{\n(.*?)\n    \};\n', re.S)
+
+
+def batch_partition_functions(path):
+    """edit the partition_functions.H at path, and return whether it changed"""
+
+    path = Path(path)
+    s = path.read_text()
+
+    if "interpolate_pf_batch" in s:
+        return False
+
+    # group the per-nucleus tables by temperature grid
+    tables = TABLE_RE.findall(s)
+
+    grids = {}
+    for name, g, body in tables:
+        grids.setdefault(g, []).append((name, body))
+
+    rows = {}
+    if tables:
+        first = TABLE_RE.search(s).start()
+        new_tables = ''
+        for g, nucs in grids.items():
+            new_tables += '    // the nuclei with partition functions on temperature grid %s, in the\n' % g
+            new_tables += '    // order of the rows of pf_array_%s\n\n' % g
+            new_tables += '    constexpr int nnuc_%s = %d;\n\n' % (g, len(nucs))
+            new_tables += '    MICROPHYSICS_UNUSED HIP_CONSTEXPR static AMREX_GPU_MANAGED int nuc_%s[nnuc_%s] = {\n' % (g, g)
+            names = [n for n, _ in nucs]
+            for k in range(0, len(names), 5):
+                new_tables += '        ' + ' '.join(x + ',' for x in names[k:k+5]) + '\n'
+            new_tables += '    };\n\n'
+            new_tables += '    // this is log10(partition function), one row for each nucleus\n\n'
+            new_tables += '    MICROPHYSICS_UNUSED HIP_CONSTEXPR static AMREX_GPU_MANAGED amrex::Real pf_array_%s[nnuc_%s][npts_%s] = {\n' % (g, g, g)
+            for r, (name, body) in enumerate(nucs):
+                rows[name] = (g, r)
+                new_tables += '        // %s\n        {\n' % name
+                new_tables += '\n'.join('    ' + line for line in body.split('\n')) + '\n'
+                new_tables += '        },\n'
+            new_tables += '    };\n\n'
+        s = TABLE_RE.sub('', s)
+        s = s[:first] + new_tables + s[first:]
+
+    # replace the interpolation routine (the rest of the part_fun
+    # namespace) with the batched version
+
+    start = s.index(COMMON_OLD_START)
+    end = s.index('\n}\n', start) + 3
+    s = s[:start] + COMMON_NEW + s[end:]
+
+    # the single-nucleus interface now reads a row of the 2-D table
+    for name, (g, r) in rows.items():
+        old = 'part_fun::%s_pf_array,' % name
+        if s.count(old) != 1:
+            raise ValueError(f"{path}: expected one use of the {name} table")
+        s = s.replace(old, 'part_fun::pf_array_%s[%d],' % (g, r))
+
+    # fill the cache for all of the nuclei, one grid at a time
+
+    batch = ''
+    for g in grids:
+        batch += '\n    part_fun::interpolate_pf_batch(tfactors.T9, part_fun::temp_array_%s, part_fun::nuc_%s, part_fun::pf_array_%s, pf_cache);\n' % (g, g, g)
+
+    start = s.index('AMREX_GPU_HOST_DEVICE AMREX_INLINE\nvoid get_partition_function_cached')
+    end = s.index('// spins')
+    s = s[:start] + CACHED_NEW_TMPL % batch + s[end:]
+
+    s = re.sub(r'(    \};\n)\n{4,}(    // find the interval)', r'\1\n\n\n\2', s)
+    path.write_text(s)
+    return True
+
+
+if __name__ == "__main__":
+    for f in sys.argv[1:]:
+        if batch_partition_functions(f):
+            print(f"batched the partition functions in {f}")
@@ -6,6 +6,9 @@ import subprocess
 import sys
 from pathlib import Path
 
+from add_ad_jacobian import add_ad_jacobian
+from batch_partition_functions import batch_partition_functions
+
 # Disable slightly-less-precise AVX-512 SVML routines to avoid roundoff diffs
 # when different machines regenerate the networks. Accuracy is important here,
 # and these calculations aren't a bottleneck. See pynucastro/conftest.py for
@@ -38,5 +41,10 @@ for net_file in sorted(cwd.glob("**/pynucastro.net")):
     if result.returncode != 0:
         print(f"error: python exited with status {result.returncode}")
     else:
+        # apply the changes to the generated code that pynucastro
+        # doesn't write itself
+        add_ad_jacobian(network_dir / "actual_rhs.H")
+        if (network_dir / "partition_functions.H").exists():
+            batch_partition_functions(network_dir / "partition_functions.H")
         print("updated successfully")
     print()
@@ -0,0 +1,8 @@
+#include <nse_cache.H>
+
+#ifdef NSE_NET
+namespace nse_cache
+{
+    AMREX_GPU_MANAGED amrex::Array1D<entry_t, 0, ncache-1> entries;
+}
+#endif
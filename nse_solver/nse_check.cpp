@@ -0,0 +1,23 @@
+#include <nse_check.H>
+
+#ifdef NSE_NET
+namespace nse_check_counters
+{
+    AMREX_GPU_MANAGED unsigned long long ncalls{0};
+    AMREX_GPU_MANAGED unsigned long long nreject_thermo{0};
+    AMREX_GPU_MANAGED unsigned long long nreject_composition{0};
+    AMREX_GPU_MANAGED unsigned long long nreject_hysteresis{0};
+    AMREX_GPU_MANAGED unsigned long long nreject_molar{0};
+    AMREX_GPU_MANAGED unsigned long long naccept_T_nse_net{0};
+    AMREX_GPU_MANAGED unsigned long long ngrouping{0};
+    AMREX_GPU_MANAGED unsigned long long nin_nse{0};
+}
+
+#ifndef NEW_NETWORK_IMPLEMENTATION
+namespace nse_check_data
+{
+    AMREX_GPU_MANAGED int n_eligible{-1};
+    AMREX_GPU_MANAGED amrex::Array1D<int, 1, Rates::NumRates> eligible_rates;
+}
+#endif
+#endif
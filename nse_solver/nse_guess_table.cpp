@@ -0,0 +1,22 @@
+#include <nse_guess_table.H>
+
+#ifdef NSE_NET
+namespace nse_guess_table
+{
+    AMREX_GPU_MANAGED bool initialized{false};
+
+    AMREX_GPU_MANAGED int nrho{};
+    AMREX_GPU_MANAGED int nT{};
+    AMREX_GPU_MANAGED int nye{};
+
+    AMREX_GPU_MANAGED amrex::Real logrho_min{};
+    AMREX_GPU_MANAGED amrex::Real dlogrho{};
+    AMREX_GPU_MANAGED amrex::Real logT_min{};
+    AMREX_GPU_MANAGED amrex::Real dlogT{};
+    AMREX_GPU_MANAGED amrex::Real ye_min{};
+    AMREX_GPU_MANAGED amrex::Real dye{};
+
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 0, max_pts-1> mu_p;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 0, max_pts-1> mu_n;
+}
+#endif
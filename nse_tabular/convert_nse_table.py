@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+
+"""Convert an ASCII NSE table (as written by make_nse_table.py) into the
+binary format described in nse_table_binary.H.
+
+The binary table can be read much faster than the ASCII table and, when
+compiled with USE_NSE_TABLE_MMAP=TRUE, it is memory-mapped so that all
+of the ranks on a node share a single copy.
+
+usage: ./convert_nse_table.py nse_aprox19.tbl nse_aprox19.bin
+"""
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"NSETBL01"
+VERSION = 1
+HEADER_SIZE = 128
+NFIELDS = 6
+
+# the ASCII table has a 4 line header (see init_nse())
+ASCII_HEADER_LINES = 4
+
+
+def grid_info(vals, decreasing=False):
+    """return the number of points, the starting value, and the spacing
+    of a uniform grid given all of the table entries for that
+    coordinate"""
+
+    u = np.unique(vals)
+    if decreasing:
+        u = u[::-1]
+
+    n = len(u)
+    if n < 2:
+        sys.exit("table needs at least 2 points in each dimension")
+
+    dx = (u[-1] - u[0]) / (n - 1)
+    if not np.allclose(np.diff(u), dx, rtol=1.e-6, atol=1.e-12):
+        sys.exit("table grid is not uniform")
+
+    return n, u[0], dx
+
+
+def convert(ascii_file, binary_file):
+
+    data = np.loadtxt(ascii_file, skiprows=ASCII_HEADER_LINES)
+
+    # the first three columns are T, rho, and Ye.  They may be stored
+    # either as the value or its log10 -- we want the latter for T and rho
+
+    T = data[:, 0]
+    rho = data[:, 1]
+    ye = data[:, 2]
+
+    logT = np.log10(T) if T.max() > 100 else T
+    logrho = np.log10(rho) if rho.max() > 100 else rho
+
+    # the table grid values are generated via logspace, so round off
+    # the noise before finding the unique values
+    logT = np.round(logT, 10)
+    logrho = np.round(logrho, 10)
+    ye = np.round(ye, 10)
+
+    ntemp, logT_min, dlogT = grid_info(logT)
+    nden, logrho_min, dlogrho = grid_info(logrho)
+    nye, ye_max, dye = grid_info(ye, decreasing=True)
+    dye = -dye
+
+    npts = ntemp * nden * nye
+    if data.shape[0] != npts:
+        sys.exit(f"expected {npts} table entries, but found {data.shape[0]}")
+
+    nspec = data.shape[1] - 3 - NFIELDS
+
+    # the ASCII table is ordered with rho varying slowest and Ye varying
+    # fastest -- make sure that is the case, since the binary format
+    # uses the same ordering
+
+    order = np.lexsort((-ye, logT, logrho))
+    if not np.array_equal(order, np.arange(npts)):
+        sys.exit("table is not ordered with rho slowest and Ye fastest")
+
+    header = struct.pack("<8s6i6d", MAGIC, VERSION,
+                         nden, ntemp, nye, nspec, 0,
+                         logrho_min, dlogrho, logT_min, dlogT, ye_max, dye)
+    header += b"\0" * (HEADER_SIZE - len(header))
+
+    with open(binary_file, "wb") as f:
+        f.write(header)
+
+        # each of the scalar fields, stored contiguously
+        for n in range(NFIELDS):
+            f.write(np.ascontiguousarray(data[:, 3 + n], dtype="<f8").tobytes())
+
+        # the mass fractions, with the species varying fastest
+        f.write(np.ascontiguousarray(data[:, 3 + NFIELDS:], dtype="<f8").tobytes())
+
+    print(f"wrote {binary_file}: nden = {nden}, ntemp = {ntemp}, nye = {nye}, nspec = {nspec}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="convert an ASCII NSE table to binary")
+    parser.add_argument("ascii_table", help="ASCII table written by make_nse_table.py")
+    parser.add_argument("binary_table", help="name of the binary table to write")
+    args = parser.parse_args()
+
+    convert(args.ascii_table, args.binary_table)
+
+
+if __name__ == "__main__":
+    main()
@@ -90,6 +90,21 @@ def make_nse_network():
 
     return rc
 
+def piecewise_logspace(breaks, npts):
+    """return a grid that is logarithmically spaced within each of the
+    intervals [breaks[i], breaks[i+1]], with npts[i] points in each
+    (including the endpoints, which are shared with the neighbors).
+    This allows the table to be refined where needed, but requires
+    building with USE_NSE_TABLE_NONUNIFORM=TRUE"""
+
+    assert len(npts) == len(breaks) - 1
+
+    segments = [np.logspace(np.log10(breaks[i]), np.log10(breaks[i+1]), npts[i])
+                for i in range(len(npts))]
+
+    return np.concatenate([segments[0]] + [s[1:] for s in segments[1:]])
+
+
 def output_header(Ts, rhos, yes):
 
     with open("nse_table_size.H", "w") as nse_h:
@@ -135,6 +150,9 @@ def generate_table():
     #rhos = np.logspace(7, 10, 16)
     #yes = np.linspace(0.43, 0.5, 8)
 
+    # a nonuniform grid, refined near the NSE boundary
+    #Ts = piecewise_logspace([10**9.4, 10**9.7, 10**10.4], [61, 36])
+
     output_header(Ts, rhos, yes)
 
     mu_p0 = -3.5
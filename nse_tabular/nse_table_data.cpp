@@ -3,6 +3,24 @@
 #ifdef NSE_TABLE
 namespace nse_table
 {
+#ifdef NSE_TABLE_NONUNIFORM
+    AMREX_GPU_MANAGED grid_1d<nse_table_size::nden> logrho_grid;
+    AMREX_GPU_MANAGED grid_1d<nse_table_size::ntemp> logT_grid;
+    AMREX_GPU_MANAGED grid_1d<nse_table_size::nye> ye_grid;
+#endif
+
+#if defined(NSE_TABLE_MMAP)
+    table_view_1d abartab;
+    table_view_1d beatab;
+    table_view_1d dyedttab;
+    table_view_1d dabardttab;
+    table_view_1d dbeadttab;
+    table_view_1d enutab;
+
+    table_view_2d massfractab;
+#elif defined(NSE_TABLE_INTERLEAVED)
+    AMREX_GPU_MANAGED amrex::Array1D<table_point_t, 1, npts> tabdata;
+#else
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> abartab;
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> beatab;
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dyedttab;
@@ -10,6 +28,7 @@ namespace nse_table
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> dbeadttab;
     AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> enutab;
 
-    AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, NumSpec, 1, npts> massfractab;
+    AMREX_GPU_MANAGED amrex::Array2D<X_t, 1, NumSpec, 1, npts> massfractab;
+#endif
 }
 #endif
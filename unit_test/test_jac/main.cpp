@@ -185,6 +185,31 @@ void main_main ()
     const int IOProc = ParallelDescriptor::IOProcessorNumber();
     ParallelDescriptor::ReduceRealMax(stop_time, IOProc);
 
+    if (jac_check_tol > 0.0_rt) {
+
+        const Real err_spec = state.max(vars.ierr_spec);
+        const Real err_enuc = state.max(vars.ierr_enuc);
+        const Real err_color = state.max(vars.ierr_color);
+
+        amrex::Print() << "maximum normwise Jacobian difference, species rows = " << err_spec << std::endl;
+        amrex::Print() << "maximum normwise Jacobian difference, energy row = " << err_enuc << std::endl;
+        amrex::Print() << "maximum normwise colored vs. dense difference = " << err_color << std::endl;
+
+        if (err_spec > jac_check_tol || err_enuc > jac_check_tol || err_color > jac_check_tol) {
+            amrex::Error("numerical and analytic Jacobians differ by more than unit_test.jac_check_tol");
+        }
+
+#ifdef AD_JACOBIAN
+        const Real err_ad = state.max(vars.ierr_ad);
+
+        amrex::Print() << "maximum normwise AD vs. generated species Jacobian difference = " << err_ad << std::endl;
+
+        if (err_ad > jac_check_tol) {
+            amrex::Error("AD and generated species Jacobians differ by more than unit_test.jac_check_tol");
+        }
+#endif
+    }
+
     // get the name of the integrator from the build info functions
     // written at compile time.  We will append the name of the
     // integrator to the output file name
@@ -12,6 +12,11 @@ plot_t init_variables() {
 
   p.ijac = p.next_index(neqs * neqs);
 
+  p.ierr_spec = p.next_index(1);
+  p.ierr_enuc = p.next_index(1);
+  p.ierr_color = p.next_index(1);
+  p.ierr_ad = p.next_index(1);
+
   return p;
 
 }
@@ -53,5 +58,10 @@ void get_varnames(const plot_t& p, amrex::Vector<std::string>& names) {
       }
   }
 
+  names[p.ierr_spec] = "err_J_species_norm";
+  names[p.ierr_enuc] = "err_J_enuc_norm";
+  names[p.ierr_color] = "err_J_colored_norm";
+  names[p.ierr_ad] = "err_J_ad_norm";
+
 }
 
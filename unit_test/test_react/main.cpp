@@ -182,7 +182,20 @@ void main_main ()
 
     // allocate a multifab for the number of RHS calls and steps
     // so we can manually do the reductions (for GPU)
-    iMultiFab integrator_n_rhs(ba, dm, 2, Nghost);
+    // (and, with warm_start, the number of RHS calls for the second
+    // burn from a cold and a warm start)
+    iMultiFab integrator_n_rhs(ba, dm, 4, Nghost);
+
+#ifdef INTEGRATOR_HAS_HISTORY
+    // with warm_start, storage for the integrator history of each zone
+    // between the burns
+    Gpu::DeviceVector<Real> zone_history;
+    if (warm_start) {
+        const long n_zones = static_cast<long>(n_cell) * n_cell * n_cell;
+        zone_history.resize(n_zones * integrator_history_size, 0.0_rt);
+    }
+    Real* zone_history_d = zone_history.data();
+#endif
 
     // What time is it now?  We'll use this to compute total react time.
     Real strt_time = ParallelDescriptor::second();
@@ -207,8 +220,16 @@ void main_main ()
             Array4<Real> const& s = ma[box_no];
             auto n_rhs = ia[box_no];
 
+            Real* history = nullptr;
+#ifdef INTEGRATOR_HAS_HISTORY
+            if (warm_start) {
+                const long zone = i + static_cast<long>(n_cell) * (j + static_cast<long>(n_cell) * k);
+                history = zone_history_d + zone * integrator_history_size;
+            }
+#endif
+
             burn_t burn_state;
-            bool success = do_react(i, j, k, s, burn_state, n_rhs, vars);
+            bool success = do_react(i, j, k, s, burn_state, n_rhs, vars, history);
 
             if (!success) {
                 Gpu::Atomic::Add(num_failed_d, 1);
@@ -267,6 +288,9 @@ void main_main ()
     int n_step_max = integrator_n_rhs.max(1);
     long n_step_sum = integrator_n_rhs.sum(1);
 
+    long n_rhs_cold = integrator_n_rhs.sum(2);
+    long n_rhs_warm = integrator_n_rhs.sum(3);
+
     if (ParallelDescriptor::IOProcessor()) {
 
         // Tell the I/O Processor to write out the "run time"
@@ -282,6 +306,11 @@ void main_main ()
         std::cout << "avg number of steps: " << n_step_sum / n_cell_cubed << std::endl;
         std::cout << "max number of steps: " << n_step_max << std::endl;
 
+        if (warm_start) {
+            std::cout << "second burn, total rhs calls from a cold start: " << n_rhs_cold << std::endl;
+            std::cout << "second burn, total rhs calls from a warm start: " << n_rhs_warm << std::endl;
+        }
+
     }
 
     // output the state that took the most time